@@ -0,0 +1,105 @@
+#!/bin/sh
+#
+# Tiny BASIC Interpreter image test
+#
+# usage: sh TestImg.sh
+#
+# Writes the image of a small prog, corrupts it in a few ways, and checks
+# that every corrupted image is dropped, i.e. the source is scanned and
+# the prog runs as it does without an image.
+# The header locs below are those of struct ImgHeader on a 64-bit system.
+#
+# The interpreter is ./TinyBASIC, or $TINYBASIC if set.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+exe=${TINYBASIC:-$dir/TinyBASIC}
+failed=0
+
+if [ ! -x "$exe" ]
+then
+  echo "Error: cannot find the interpreter $exe. Run make first."
+  exit 2
+fi
+
+work=$(mktemp -d) || exit 2
+trap 'rm -rf "$work"' EXIT
+prog=$work/prog.bas
+
+cat > "$prog" <<'EOF'
+Q = 1
+10
+Q = Q + 2 * 3
+IF Q < 20 THEN
+  GOTO 10
+ENDIF
+PRINT "Q =", Q
+END
+EOF
+
+# read the int of n bytes at loc of the image
+img_int()
+{
+  od -An -t d"$2" -j "$1" -N "$2" "$prog.img" | tr -d ' '
+}
+
+# write the 4 bytes of str at loc of the image
+img_patch()
+{
+  printf "$2" | dd of="$prog.img" bs=1 seek="$1" conv=notrunc 2> /dev/null
+}
+
+rm -f "$prog.img"
+"$exe" "$prog" > "$work/expected" 2>&1
+
+if ! "$exe" -c "$prog"
+then
+  echo "Error: cannot write the image."
+  exit 1
+fi
+
+cp "$prog.img" "$work/good.img"
+tok_size=$(img_int 20 4)
+tok_count=$(img_int 48 4)
+tok_loc=$(img_int 64 8)
+pool_loc=$(img_int 72 8)
+
+# name test: what is done to the image
+check()
+{
+  if "$exe" "$prog" > "$work/out" 2>&1 && cmp -s "$work/expected" "$work/out"
+  then
+    echo "OK      $1"
+  else
+    echo "FAILED  $1"
+    failed=$((failed + 1))
+  fi
+
+  cp "$work/good.img" "$prog.img"
+}
+
+check "no change"
+
+i=0
+
+while [ $i -lt "$tok_count" ]  # the Expr field is the last of a token
+do
+  img_patch $((tok_loc + i * tok_size + tok_size - 4)) '\377\377\377\177'
+  i=$((i + 1))
+done
+
+check "expr locs out of the expr table"
+
+img_patch $((tok_loc + tok_size - 8)) '\377\377\377\177'
+check "jump out of the token array"
+
+img_patch $((tok_loc + 16)) '\377\377\377\177'
+check "str out of the string pool"
+
+img_patch $((pool_loc + 1)) '['  # the name of the 1st var, Q
+check "var name not in A ... Z"
+
+if [ $failed -gt 0 ]
+then
+  echo "$failed of the tests failed."
+  exit 1
+fi
@@ -0,0 +1,26 @@
+REM Benchmark: indexed array access and bulk array ops.
+
+DIM A(99999), B(99999), M(299, 299)
+
+FOR I = 0 TO 99999
+  A(I) = I % 100
+  B(I) = 1 + I % 7
+NEXT
+
+FOR I = 0 TO 299
+  FOR J = 0 TO 299
+    M(I, J) = M(I, J) + I - J
+  NEXT
+NEXT
+
+S = 0
+
+FOR K = 1 TO 8000
+  SCALE B, B, 0.5
+  ADD A, A, B
+  S = S + SUM(A) + DOT(A, B) + MAX(M) - MIN(M)
+  FILL B, K % 7
+NEXT
+
+PRINT "S =", S
+END
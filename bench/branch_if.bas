@@ -0,0 +1,26 @@
+REM Benchmark: branch-heavy IF ... ELSE ... ENDIF.
+
+A = 0
+B = 0
+C = 0
+
+FOR I = 1 TO 30000000
+  X = I % 4
+
+  IF X = 0 THEN
+    A = A + 1
+  ELSE
+    IF X = 1 THEN
+      B = B + 1
+    ELSE
+      IF X > 2 AND NOT A < B THEN
+        C = C + 1
+      ELSE
+        C = C - 1
+      ENDIF
+    ENDIF
+  ENDIF
+NEXT
+
+PRINT "A =", A, "B =", B, "C =", C
+END
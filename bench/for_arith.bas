@@ -0,0 +1,12 @@
+REM Benchmark: tight FOR ... NEXT arithmetic.
+
+S = 0
+T = 0
+
+FOR I = 1 TO 40000000
+  S = S + I * 3 - 1
+  T = T + (I + 7) / 2 - S / 1000
+NEXT
+
+PRINT "S =", S
+END
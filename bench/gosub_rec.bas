@@ -0,0 +1,20 @@
+REM Benchmark: deep GOSUB recursion.
+REM Every call goes 5000 levels deep.
+
+R = 0
+
+FOR I = 1 TO 8000
+  N = 5000
+  GOSUB 100
+NEXT
+
+PRINT "R =", R
+END
+
+100
+IF N > 0 THEN
+  N = N - 1
+  R = R + 1
+  GOSUB 100
+ENDIF
+RETURN
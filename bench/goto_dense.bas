@@ -0,0 +1,47 @@
+REM Benchmark: a state machine of GOTOs between many labels.
+
+N = 0
+S = 0
+
+10
+N = N + 1
+
+IF N > 15000000 THEN
+  GOTO 999
+ENDIF
+
+GOTO 50
+
+20
+S = S + 2
+GOTO 60
+
+30
+S = S - 1
+GOTO 80
+
+40
+S = S + 3
+GOTO 70
+
+50
+S = S + 1
+GOTO 30
+
+60
+S = S - 2
+GOTO 40
+
+70
+S = S - 3
+GOTO 90
+
+80
+GOTO 20
+
+90
+GOTO 10
+
+999
+PRINT "S =", S
+END
@@ -0,0 +1,24 @@
+REM Benchmark: nested WHILE ... WEND and DO ... UNTIL loops.
+
+S = 0
+I = 0
+
+WHILE I < 20000
+  J = 0
+
+  DO
+    K = 0
+
+    WHILE K < 100
+      K = K + 1
+      S = S + K
+    WEND
+
+    J = J + 1
+  UNTIL J = 30
+
+  I = I + 1
+WEND
+
+PRINT "S =", S
+END
@@ -0,0 +1,9 @@
+REM Benchmark: PRINT-heavy output, strs and numbers.
+
+PRECISION 2
+
+FOR I = 1 TO 30000000
+  PRINT "row", I; I * 1.5; I / 3, "end"
+NEXT
+
+END
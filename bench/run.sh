@@ -0,0 +1,182 @@
+#!/bin/sh
+#
+# Tiny BASIC Interpreter benchmark runner
+#
+# usage: bench/run.sh [ --save ] [ --runs N ] [ --tolerance PCT ]
+#
+# Runs every bench/*.bas program, plus a large generated source, as is
+# and from its image, and reports the statements/sec, wall time and peak
+# memory of each. Every program is sampled N times (5 by default) and the
+# median sample counts, not the best one. A sample takes a few secs: the
+# bench/*.bas programs run that long, and the large ones, which mostly
+# load, run many times in a row.
+#
+# The results are compared against bench/baseline.txt. The spread of a
+# program is the max time of its samples less the min one, in percent of
+# the median. A program regresses if:
+#   - its rate is lower, or its time higher, than in the baseline by more
+#     than PCT percent (10 by default) plus its spread in the results
+#     plus its spread in the baseline, or
+#   - its memory is higher by more than PCT percent and by at least 1 MB.
+# So the limit of a noisy program is well over PCT percent, and a larger
+# regression of it can pass. The runner fails if any program regresses.
+# --save makes the results the new baseline.
+# A baseline depends on the machine, so it is not kept in the source tree.
+#
+# The interpreter is ./TinyBASIC, or $TINYBASIC if set.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+exe=${TINYBASIC:-$dir/../TinyBASIC}
+baseline=$dir/baseline.txt
+save=0
+runs=5
+tolerance=10
+mem_floor=1024  # KB
+large_reps=40  # runs of a large program per sample
+
+while [ $# -gt 0 ]
+do
+  case $1 in
+    --save) save=1 ;;
+    --runs) runs=$2; shift ;;
+    --tolerance) tolerance=$2; shift ;;
+    *) echo "usage: $0 [ --save ] [ --runs N ] [ --tolerance PCT ]"; exit 2 ;;
+  esac
+  shift
+done
+
+if [ ! -x "$exe" ]
+then
+  echo "Error: cannot find the interpreter $exe. Run make first."
+  exit 2
+fi
+
+work=$(mktemp -d) || exit 2
+trap 'rm -rf "$work"' EXIT
+
+# a large source, i.e. many labels, lines and exprs to load and compile
+awk 'BEGIN {
+  print "REM Benchmark: a large generated source."
+  print "A = 0"
+  print "B = 0"
+  print "C = 0"
+  for (i = 1; i <= 40000; i++)
+  {
+    print i
+    print "A = A + " i " * 2 - B"
+    print "B = A - " i " + (C + 1) * 3"
+    print "IF A > B THEN"
+    print "  C = C + 1"
+    print "ENDIF"
+  }
+  print "PRINT \"C =\", C"
+  print "END"
+}' > "$work/large_source.bas"
+
+# the same source, loaded from its image
+cp "$work/large_source.bas" "$work/large_image.bas"
+
+if ! "$exe" -c "$work/large_image.bas"
+then
+  echo "Error: cannot compile large_image."
+  exit 1
+fi
+
+# run every program and keep the median sample:
+# name statements time rate memory spread
+for prog in "$dir"/*.bas "$work/large_source.bas" "$work/large_image.bas"
+do
+  name=$(basename "$prog" .bas)
+  reps=1
+
+  case $name in
+    large_*) reps=$large_reps ;;
+  esac
+
+  run=0
+
+  while [ $run -lt "$runs" ]
+  do
+    rep=0
+
+    while [ $rep -lt $reps ]
+    do
+      if ! "$exe" -o /dev/null --stats "$prog" 2> "$work/stats"
+      then
+        echo "Error: $name failed."
+        cat "$work/stats"
+        exit 1
+      fi
+
+      # Statements = N, Time = T s, Statements/sec = R, Peak memory = M KB
+      tr -d ',' < "$work/stats" |
+        awk '{ for (i = 1; i < NF; i++) if ($i == "=") printf "%s ", $(i+1); print "" }'
+      rep=$((rep + 1))
+    done > "$work/reps"
+
+    # a sample is the sum of its runs, and the peak memory of them
+    awk '{ stmts += $1; time += $2; if ($4 > mem) mem = $4 }
+      END { printf "%.0f %.6f %.0f %d\n", stmts, time, (time > 0) ? stmts / time : 0, mem }' \
+      "$work/reps"
+    run=$((run + 1))
+  done > "$work/runs"
+
+  mid=$(( (runs + 1) / 2 ))
+  mem=$(sort -n -k 4 "$work/runs" | awk -v mid=$mid 'NR == mid { print $4 }')
+  # the spread is the max time less the min one, in percent of the median
+  sort -n -k 2 "$work/runs" |
+    awk -v name="$name" -v mid=$mid -v mem="$mem" '
+      NR == 1 { min = $2 }
+      NR == mid { stmts = $1; time = $2; rate = $3 }
+      END { printf "%s %s %s %s %s %.1f\n", name, stmts, time, rate, mem,
+        (time > 0) ? ($2 - min) * 100.0 / time : 0 }'
+done > "$work/results"
+
+if [ $save = 1 ]
+then
+  cp "$work/results" "$baseline"
+  echo "Baseline saved to $baseline."
+fi
+
+if [ ! -f "$baseline" ]
+then
+  touch "$work/baseline"
+  echo "No baseline: run make bench-save to save one."
+else
+  cp "$baseline" "$work/baseline"
+fi
+
+# compare the results with the baseline, higher rate and lower time and
+# memory are better
+awk -v tol="$tolerance" -v mem_floor="$mem_floor" '
+  function change(new, old) { return (old > 0) ? (new - old) * 100.0 / old : 0 }
+  FILENAME == ARGV[1] {
+    base[$1] = 1; brate[$1] = $4; btime[$1] = $3; bmem[$1] = $5; bspread[$1] = $6
+    next
+  }
+  FNR == 1 {
+    printf "%-16s %15s %8s %12s %8s %12s %8s\n", "Program", "Statements/sec",
+      "", "Time (s)", "", "Memory (KB)", ""
+  }
+  {
+    if (!($1 in base))
+    {
+      printf "%-16s %15.0f %8s %12.6f %8s %12d %8s\n", $1, $4, "", $3, "", $5, ""
+      next
+    }
+
+    r = change($4, brate[$1]); t = change($3, btime[$1]); m = change($5, bmem[$1])
+    lim = tol + $6 + bspread[$1]  # the tolerance plus the noise
+    bad = (r < -lim) || (t > lim) || (m > tol && $5 - bmem[$1] >= mem_floor)
+    failed += bad
+    printf "%-16s %15.0f %+7.1f%% %12.6f %+7.1f%% %12d %+7.1f%%%s\n", $1, $4, r,
+      $3, t, $5, m, bad ? "  REGRESSION" : ""
+  }
+  END {
+    if (failed)
+    {
+      printf "\n%d of the programs regressed by more than %s%% plus their noise.\n",
+        failed, tol
+      exit 1
+    }
+  }' "$work/baseline" "$work/results"